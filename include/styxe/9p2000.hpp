@@ -26,6 +26,8 @@
 #include <solace/error.hpp>
 #include <solace/path.hpp>
 
+#include <functional>  // std::hash
+
 
 namespace styxe {
 
@@ -44,6 +46,7 @@ enum class CannedError : int {
     UnsupportedMessageType,
     NotEnoughData,
     MoreThenExpectedData,
+    TooManyWalkElements,
 };
 
 /**
@@ -204,6 +207,18 @@ public:
         _endSupportedMessageCode
     };
 
+    /**
+     * Priority class of a request.
+     * Classes are ordered by priority: requests of a lower class should be executed before requests of a higher one
+     * so that small interactive requests are not blocked behind bulk data transfers.
+     */
+    enum class RequestPriority : Solace::byte {
+        Flush = 0,      //!< Flush requests: must not wait behind the requests they are to abort.
+        Metadata,       //!< Requests that do not transfer file data: walk, open, stat, clunk etc.
+        SmallIO,        //!< Reads and writes of a small amount of data.
+        BulkIO,         //!< Reads and writes of a large amount of data.
+    };
+
     /**
      * The qid represents the server's unique identification for the file being accessed:
      * two files on the same server hierarchy are the same if and only if their qids are the same.
@@ -216,6 +231,9 @@ public:
 
     /**
      * Stat about a file on the server.
+     * @note String fields of a parsed stat refer to the message buffer it was parsed from.
+     * To keep a stat after the buffer has been reused, encode it into a storage owned by the user with Encoder
+     * and decode it back with Decoder when required.
      */
     struct Stat {
         Solace::uint16      size;       //!< Total byte count of the following data
@@ -506,6 +524,13 @@ public:
          */
         struct Session {
             Solace::byte key[8];    //!< A key of the previously established session.
+
+            /**
+             * Get session key as a single number.
+             * This allows a server to use the key to look up a parked session in O(1).
+             * @return Session key interpreted as a little-endian 64 bit integer.
+             */
+            Solace::uint64 id() const noexcept;
         };
 
         /**
@@ -535,6 +560,16 @@ public:
 
         MessageType type() const noexcept { return _type; }
 
+        /**
+         * Get the fid this request operates on.
+         * Requests on the same fid must be executed in order, while requests on different fids can be
+         * executed concurrently.
+         * @note Walk request also establishes a newfid: requests on the newfid must be ordered after the walk.
+         * Attach request also depends on afid: it must be ordered after the authentication exchange on the afid.
+         * @return Fid of the file request operates on or NOFID for requests that are not bound to a fid.
+         */
+        Fid fid() const noexcept;
+
         Version&        asVersion();
         Auth&           asAuth();
         Flush&          asFlush();
@@ -552,6 +587,23 @@ public:
         SRead&          asShortRead();
         SWrite&         asShortWrite();
 
+        Version const&      asVersion() const;
+        Auth const&         asAuth() const;
+        Flush const&        asFlush() const;
+        Attach const&       asAttach() const;
+        Walk const&         asWalk() const;
+        Open const&         asOpen() const;
+        Create const&       asCreate() const;
+        Read const&         asRead() const;
+        Write const&        asWrite() const;
+        Clunk const&        asClunk() const;
+        Remove const&       asRemove() const;
+        StatRequest const&  asStat() const;
+        WStat const&        asWstat() const;
+        Session const&      asSession() const;
+        SRead const&        asShortRead() const;
+        SWrite const&       asShortWrite() const;
+
     private:
 
         Tag             _tag;
@@ -579,8 +631,22 @@ public:
     };
 
 
+    /**
+     * Request message together with the memory of the frame it has been parsed from.
+     * Parsed requests only reference data in the message buffer (Write::data, Stat strings, etc).
+     * Keeping the frame with the request allows it to outlive the receive buffer. For example
+     * the request can be handed over to a different thread without copying the data.
+     */
+    struct OwnedRequest {
+        Solace::MemoryResource  frame;      //!< Memory of the frame referenced by the request.
+        Request                 request;    //!< Request parsed from the frame.
+    };
+
+
     /**
      * Helper class to build Request messages.
+     * Each call encodes a message at the current position of the destination buffer, thus consecutive calls
+     * produce a batch of messages that can be sent with a single write.
      */
     class RequestBuilder {
     public:
@@ -623,7 +689,49 @@ public:
         RequestBuilder& flush(Tag oldTransation);
         RequestBuilder& attach(Fid fid, Fid afid,
                                 Solace::StringView userName, Solace::StringView attachName);
+        /**
+         * Get the number of walk messages required to walk a path.
+         * A single walk message can have no more then MAX_WELEM path elements,
+         * thus longer paths must be walked by a chain of messages.
+         * @param path Path to walk.
+         * @return Number of walk messages required to walk the path.
+         */
+        static size_type walkMessageCount(Solace::Path const& path) noexcept;
+
+        /**
+         * Create a walk request.
+         * @param fid Fid of the directory to walk from.
+         * @param nfid A new fid to represent the file walked to.
+         * @param path Path to walk. Must have no more then MAX_WELEM elements.
+         * @return Ref to this for fluent interface.
+         */
         RequestBuilder& walk(Fid fid, Fid nfid, Solace::Path const& path);
+
+        /**
+         * Create a walk request for a part of a path that is too long to be walked by a single message.
+         * Each of walkMessageCount(path) parts must be sent as a separate message with its own tag.
+         * The first part walks from fid and the following parts walk from nfid, thus parts can be sent at once
+         * without waiting for responses. If a walk stops short, the number of qids in the response tells how
+         * many path elements were walked and the following parts fail as nfid has not been established.
+         * @note Walk of more then MAX_WELEM elements requires nfid to be different from fid:
+         * a walk that stops short leaves fid unchanged and the following parts would walk from the wrong file.
+         *
+         * @param fid Fid of the directory to walk from.
+         * @param nfid A new fid to represent the file walked to. Must be different from fid for multi-part walks.
+         * @param path Path to walk.
+         * @param part Index of the part of the path to walk, less then walkMessageCount(path).
+         * @return Ref to this for fluent interface.
+         */
+        RequestBuilder& walk(Fid fid, Fid nfid, Solace::Path const& path, size_type part);
+
+        /**
+         * Create a walk request with no path components, that makes nfid represent the same file as fid.
+         * A client can use it to keep a fid for a directory and clone it for every walk from that directory.
+         * @param fid Fid of the file to clone.
+         * @param nfid A new fid to represent the same file.
+         * @return Ref to this for fluent interface.
+         */
+        RequestBuilder& clone(Fid fid, Fid nfid);
         RequestBuilder& open(Fid fid, OpenMode mode);
         RequestBuilder& create(Fid fid,
                                 Solace::StringView name,
@@ -716,6 +824,9 @@ public:
 
     /**
      * Helper class to build response messages.
+     * Message is encoded directly into the destination buffer starting from its current position.
+     * That allows a user to batch a number of responses into a single pre-allocated buffer,
+     * (for example a buffer registered with the kernel for I/O) and send them all with one write.
      */
     class ResponseBuilder {
     public:
@@ -762,9 +873,25 @@ public:
         ResponseBuilder& flush();
         ResponseBuilder& attach(Qid const& qid);
         ResponseBuilder& walk(Solace::Array<Qid> const& qids);
+
+        /**
+         * Create a walk response from a fixed size array of qids.
+         * This allows a server to build a response from a resolved (or cached) walk without allocating memory.
+         * @param walk Walk response with up to MAX_WELEM qids.
+         * @return Ref to this for a fluent interface.
+         */
+        ResponseBuilder& walk(Response::Walk const& walk);
         ResponseBuilder& open(Qid const& qid, size_type iounit);
         ResponseBuilder& create(Qid const& qid, size_type iounit);
         ResponseBuilder& read(Solace::MemoryView const& data);
+
+        /**
+         * Start a read response with no data.
+         * File content can then be written directly into the buffer() to avoid copying it.
+         * Once done call build(true) or updatePayloadSize() to update the message and data size.
+         * @return Ref to this for a fluent interface.
+         */
+        ResponseBuilder& read();
         ResponseBuilder& write(size_type iounit);
         ResponseBuilder& clunk();
         ResponseBuilder& remove();
@@ -774,6 +901,14 @@ public:
         /* 9P2000.e extention */
         ResponseBuilder& session();
         ResponseBuilder& shortRead(Solace::MemoryView const& data);
+
+        /**
+         * Start a short read response with no data.
+         * File content can then be written directly into the buffer() to avoid copying it.
+         * Once done call build(true) or updatePayloadSize() to update the message and data size.
+         * @return Ref to this for a fluent interface.
+         */
+        ResponseBuilder& shortRead();
         ResponseBuilder& shortWrite(size_type iounit);
 
     private:
@@ -856,6 +991,14 @@ public:
         _negotiatedVersion = std::move(version);
     }
 
+    /**
+     * Check if 9P2000.e extension messages can be used in the established session.
+     * A client can use this to replace walk/open/read/clunk sequences with a single short read
+     * and fall back to the standard sequence if a server only speaks plain 9P2000.
+     * @return True if negotiated protocol version is the extended one.
+     */
+    bool isExtensionNegotiated() const;
+
     /**
      * Parse 9P message header from a byte byffer.
      * @param buffer Byte buffer to read message header from.
@@ -864,6 +1007,18 @@ public:
     Solace::Result<MessageHeader, Solace::Error>
     parseMessageHeader(Solace::ByteReader& buffer) const;
 
+    /**
+     * Get size of the message frame at the start of the given data without consuming it.
+     * This allows a framer to check if a complete message has been received and to parse it in-place,
+     * for example directly from a ring buffer, without copying the frame first.
+     *
+     * @param data Received data starting at a message boundary.
+     * @return Size of the frame in bytes, including the header, or an error if the message header is ill-formed.
+     * If there is not enough data to read the header - size of the header is returned.
+     */
+    Solace::Result<size_type, Solace::Error>
+    frameSize(Solace::MemoryView data) const;
+
     /**
      * Parse 9P Response type message from a byte byffer.
      * This is the primiry method used by a client to parse response from the server.
@@ -886,6 +1041,90 @@ public:
     Solace::Result<Request, Solace::Error>
     parseRequest(MessageHeader const& header, Solace::ByteReader& data) const;
 
+    /**
+     * Parse 9P Request type message from a frame, taking ownership of the frame memory.
+     * Frame must start with a message header. Any data past the message size declared in the header is ignored.
+     *
+     * @param frame Memory buffer holding a single message.
+     * @return Resulting message that owns the frame if parsed successfully or an error otherwise.
+     */
+    Solace::Result<OwnedRequest, Solace::Error>
+    parseRequest(Solace::MemoryResource&& frame) const;
+
+    /**
+     * Get the size of a buffer sufficient to hold a successful response to the given request.
+     * This allows a server to choose a response buffer of an appropriate size class instead of
+     * allocating maxNegotiatedMessageSize() bytes for every message.
+     * @note Size of an error response is only bound by the size of the error message.
+     *
+     * @param request A request to be responded to.
+     * @return Size in bytes of the largest response message for the request.
+     */
+    size_type maxResponseSize(Request const& request) const;
+
+    /**
+     * Get the number of bytes of memory required to serve a request.
+     * This is the size of the request message itself plus the size of the largest response to it,
+     * that a server can charge against a memory budget when the request is parsed and release
+     * once the response has been sent.
+     *
+     * @param header Header of the request message.
+     * @param request A request to be served.
+     * @return Number of bytes of memory required to hold both the request and its response.
+     */
+    size_type memoryCost(MessageHeader const& header, Request const& request) const;
+
+    /**
+     * Get the largest number of bytes that can be requested by a single read.
+     * Reads of no more then this count are guaranteed to fit in one response message,
+     * so a client can use it to split a large sequential read into a number of requests in flight.
+     *
+     * @param iounit I/O unit of the opened file as returned in response to an open or create request.
+     * Value of 0 means no I/O unit is set for the file and only negotiated message size is considered.
+     * @return Maximum number of bytes to request in a read.
+     */
+    size_type maxReadCount(size_type iounit = 0) const noexcept;
+
+    /**
+     * Get the largest number of bytes that can be written by a single write request.
+     * A client can use it to coalesce a number of small writes into fewer, larger write requests.
+     *
+     * @param iounit I/O unit of the opened file as returned in response to an open or create request.
+     * Value of 0 means no I/O unit is set for the file and only negotiated message size is considered.
+     * @return Maximum number of bytes of data in a write request.
+     */
+    size_type maxWriteCount(size_type iounit = 0) const noexcept;
+
+    /**
+     * Get the number of bytes of file data a request transfers.
+     * This is the cost of a request for the purposes of rate limiting data transfer.
+     * @note Size of data returned by a short read is only known once the file has been read, thus it is not counted.
+     * @note Read count is bound by maxReadCount() as no response can carry more data then that.
+     *
+     * @param request A request to examine.
+     * @return Number of bytes to be read or written by the request or 0 if the request does not transfer file data.
+     */
+    size_type ioSize(Request const& request) const noexcept;
+
+    /**
+     * Get priority class of a request.
+     * @param request A request to classify.
+     * @param bulkIOThreshold Reads and writes of more then this number of bytes are considered bulk transfers.
+     * @return Priority class of the request.
+     */
+    RequestPriority priority(Request const& request, size_type bulkIOThreshold = 4*1024) const noexcept;
+
+    /**
+     * Check if a request can be safely sent again.
+     * When a connection is re-established, a client can re-send idempotent requests that were in flight,
+     * while the outcome of any other request is unknown and must be reported to the caller.
+     * @note A walk is only idempotent if it walks to a new fid, as walking a fid to itself changes the fid.
+     *
+     * @param request A request to check.
+     * @return True if executing the request more then once has the same effect as executing it once.
+     */
+    static bool isIdempotent(Request const& request) noexcept;
+
 private:
 
     size_type const         _maxMassageSize;                /// Initial value of the maximum message size in bytes.
@@ -904,6 +1143,12 @@ bool operator == (Protocol::Qid const& lhs, Protocol::Qid const& rhs) {
 }
 
 
+inline
+bool operator != (Protocol::Qid const& lhs, Protocol::Qid const& rhs) {
+    return !(lhs == rhs);
+}
+
+
 inline
 bool operator == (Protocol::Stat const& lhs, Protocol::Stat const& rhs) {
     return (lhs.atime == rhs.atime &&
@@ -916,8 +1161,30 @@ bool operator == (Protocol::Stat const& lhs, Protocol::Stat const& rhs) {
             lhs.qid == rhs.qid &&
             lhs.size == rhs.size &&
             lhs.type == rhs.type &&
-            lhs.uid == rhs.uid);
+            lhs.uid == rhs.uid &&
+            lhs.muid == rhs.muid);
 }
 
 }  // end of namespace styxe
+
+
+namespace std {
+
+/**
+ * Hash of a Qid, so that it can be used as a key of unordered containers.
+ * Qids of different versions of the same file have different hashes, thus cached data for a file
+ * is not found once the file has changed.
+ */
+template <>
+struct hash<styxe::Protocol::Qid> {
+    size_t operator() (styxe::Protocol::Qid const& qid) const noexcept {
+        size_t seed = hash<Solace::uint64>()(qid.path);
+        seed ^= hash<Solace::uint32>()(qid.version) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        seed ^= hash<Solace::byte>()(qid.type) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+
+        return seed;
+    }
+};
+
+}  // end of namespace std
 #endif  // STYXE_9P2000_HPP
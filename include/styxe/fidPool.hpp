@@ -0,0 +1,91 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+#pragma once
+#ifndef STYXE_FIDPOOL_HPP
+#define STYXE_FIDPOOL_HPP
+
+#include "9p2000.hpp"
+
+
+namespace styxe {
+
+/**
+ * An allocator of fids for a client connection.
+ *
+ * Fids are chosen by a client and each fid in use holds some state on the server.
+ * The pool hands out the lowest available fids and limits the number of fids in use to a given limit.
+ * @note A fid should only be released once the server has responded to its clunk (or remove).
+ * Clunks of a number of fids no longer needed can be written into one buffer and sent together,
+ * with fids released as the responses arrive.
+ *
+ * @note The pool has a fixed size and does not allocate memory.
+ */
+class FidPool {
+public:
+    using size_type = Solace::uint32;
+
+    /** Maximum number of fids that can be in use at the same time */
+    static constexpr size_type kCapacity = 64*1024;
+
+public:
+
+    /**
+     * Construct a pool with all fids available.
+     * @param limit Maximum number of fids that can be in use at the same time. No more then kCapacity.
+     * This bounds the state a client keeps on the server.
+     */
+    explicit FidPool(size_type limit = kCapacity) noexcept;
+
+    /**
+     * Allocate a fid.
+     * @return A fid not currently in use or Protocol::NOFID if the limit of fids in use has been reached.
+     */
+    Protocol::Fid allocate() noexcept;
+
+    /**
+     * Return a fid to the pool so it can be allocated again.
+     * @param fid Fid to release.
+     * @return True if the fid was released and false if it was not allocated from this pool.
+     */
+    bool release(Protocol::Fid fid) noexcept;
+
+    /**
+     * Check if a fid is in use.
+     * @param fid Fid to check.
+     * @return True if the fid has been allocated and not yet released.
+     */
+    bool isAllocated(Protocol::Fid fid) const noexcept;
+
+    /** @return Number of fids in use. */
+    size_type size() const noexcept { return _size; }
+
+    /** @return Maximum number of fids that can be in use at the same time. */
+    size_type limit() const noexcept { return _limit; }
+
+    /** @return True if no fids are in use. */
+    bool empty() const noexcept { return (_size == 0); }
+
+private:
+    static constexpr size_type kBitsPerWord = 64;
+
+    Solace::uint64  _bits[kCapacity / kBitsPerWord];
+    size_type       _limit;
+    size_type       _size;
+    size_type       _firstFreeWord;     /// Index of the first word that may have a free fid.
+};
+
+}  // end of namespace styxe
+#endif  // STYXE_FIDPOOL_HPP
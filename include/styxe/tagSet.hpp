@@ -0,0 +1,86 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+#pragma once
+#ifndef STYXE_TAGSET_HPP
+#define STYXE_TAGSET_HPP
+
+#include "9p2000.hpp"
+
+#include <limits>
+
+
+namespace styxe {
+
+/**
+ * A set of message tags, such as tags of requests in-flight on a connection.
+ *
+ * A server keeps tags of requests that are queued or being processed so that it can tell
+ * if a TFlush refers to a request that is still pending. If it is not - RFlush can be sent right away.
+ * Otherwise RFlush must only be sent after the response to the old request has been sent or suppressed.
+ *
+ * @note The set has a fixed size sufficient to hold every possible tag and does not allocate memory.
+ */
+class TagSet {
+public:
+    using size_type = Solace::uint32;
+
+    /** Number of possible tag values */
+    static constexpr size_type kCapacity = static_cast<size_type>(std::numeric_limits<Protocol::Tag>::max()) + 1;
+
+public:
+
+    /** Construct an empty set of tags. */
+    TagSet() noexcept;
+
+    /**
+     * Check if the set contains a given tag.
+     * @param tag Tag to look for.
+     * @return True if the tag is in the set.
+     */
+    bool contains(Protocol::Tag tag) const noexcept;
+
+    /**
+     * Add a tag to the set.
+     * @param tag Tag to add.
+     * @return True if the tag was added and false if it was already in the set.
+     */
+    bool insert(Protocol::Tag tag) noexcept;
+
+    /**
+     * Remove a tag from the set.
+     * @param tag Tag to remove.
+     * @return True if the tag was removed and false if it was not in the set.
+     */
+    bool erase(Protocol::Tag tag) noexcept;
+
+    /** Remove all tags from the set. */
+    void clear() noexcept;
+
+    /** @return Number of tags in the set. */
+    size_type size() const noexcept { return _size; }
+
+    /** @return True if the set has no tags. */
+    bool empty() const noexcept { return (_size == 0); }
+
+private:
+    static constexpr size_type kBitsPerWord = 64;
+
+    Solace::uint64  _bits[kCapacity / kBitsPerWord];
+    size_type       _size;
+};
+
+}  // end of namespace styxe
+#endif  // STYXE_TAGSET_HPP
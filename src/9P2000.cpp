@@ -49,6 +49,7 @@ Error const kCannedErrors[] = {
 
     CANNE(CannedError::NotEnoughData, "Ill-formed message: Declared frame size larger than message data received"),
     CANNE(CannedError::MoreThenExpectedData, "Ill-formed message: Declared frame size less than message data received"),
+    CANNE(CannedError::TooManyWalkElements, "Ill-formed message: Number of walk elements exceeds maximum"),
 };
 
 
@@ -189,6 +190,10 @@ parseWalkResponse(const Protocol::MessageHeader& header, ByteReader& data) {
     // FIXME: Non-sense!
     return decoder.read(&fcall.walk.nqids)
             .then([&decoder, &fcall]() -> Result<void, Error> {
+                if (fcall.walk.nqids > Protocol::MAX_WELEM) {
+                    return Err(getCannedError(CannedError::TooManyWalkElements));
+                }
+
                 for (decltype(fcall.walk.nqids) i = 0; i < fcall.walk.nqids; ++i) {
                     auto r = decoder.read(&fcall.walk.qids[i]);
                     if (!r) {
@@ -390,6 +395,12 @@ parseShortWriteRequest(const Protocol::MessageHeader& header, ByteReader& data)
 
 
 
+bool
+Protocol::isExtensionNegotiated() const {
+    return (_negotiatedVersion.view() == PROTOCOL_VERSION);
+}
+
+
 Result<Protocol::MessageHeader, Error>
 Protocol::parseMessageHeader(ByteReader& buffer) const {
     const auto mandatoryHeaderSize = headerSize();
@@ -431,6 +442,20 @@ Protocol::parseMessageHeader(ByteReader& buffer) const {
 }
 
 
+Result<Protocol::size_type, Error>
+Protocol::frameSize(MemoryView data) const {
+    if (data.size() < headerSize()) {
+        return Ok(headerSize());
+    }
+
+    ByteReader reader(data);
+    return parseMessageHeader(reader)
+            .then([](MessageHeader&& header) {
+                return Result<size_type, Error>(types::Ok<size_type>(header.messageSize));
+            });
+}
+
+
 Result<Protocol::Response, Error>
 Protocol::parseResponse(MessageHeader const& header, ByteReader& data) const {
     auto const expectedData = header.messageSize - headerSize();
@@ -522,6 +547,34 @@ Protocol::parseRequest(const MessageHeader& header, ByteReader& data) const {
     }
 }
 
+uint64
+Protocol::Request::Session::id() const noexcept {
+    uint64 result = 0;
+    for (size_t i = sizeof(key); i > 0; --i) {
+        result = (result << 8) | key[i - 1];
+    }
+
+    return result;
+}
+
+
+Result<Protocol::OwnedRequest, Error>
+Protocol::parseRequest(MemoryResource&& frame) const {
+    ByteReader reader(frame.view());
+
+    return parseMessageHeader(reader)
+            .then([this, &reader, &frame](MessageHeader&& header) {
+                if (header.messageSize < frame.size()) {
+                    reader.limit(header.messageSize);
+                }
+
+                return parseRequest(header, reader);
+            })
+            .then([&frame](Request&& request) {
+                return Result<OwnedRequest, Error>(types::Ok<OwnedRequest>({std::move(frame), std::move(request)}));
+            });
+}
+
 Protocol::size_type Protocol::maxNegotiatedMessageSize(size_type newMessageSize) {
     Solace::assertIndexInRange(newMessageSize, 0, maxPossibleMessageSize() + 1);
     _maxNegotiatedMessageSize = std::min(newMessageSize, maxPossibleMessageSize());
@@ -530,6 +583,142 @@ Protocol::size_type Protocol::maxNegotiatedMessageSize(size_type newMessageSize)
 }
 
 
+Protocol::size_type
+Protocol::maxResponseSize(Request const& request) const {
+    Qid const qid{};
+    size_type const count = 0;
+
+    switch (request.type()) {
+    case MessageType::TVersion: {
+        // Server may respond with either the requested version or 'unknown'
+        auto const& version = request.asVersion().version;
+        return headerSize() +
+                Encoder::protocolSize(count) +
+                Encoder::protocolSize(version.size() > UNKNOWN_PROTOCOL_VERSION.size()
+                                      ? version
+                                      : UNKNOWN_PROTOCOL_VERSION);
+    }
+    case MessageType::TAuth:
+    case MessageType::TAttach:
+        return headerSize() + Encoder::protocolSize(qid);
+    case MessageType::TWalk:
+        return headerSize() +
+                sizeof(uint16) +  // Var number of qids
+                std::min<Path::size_type>(request.asWalk().path.getComponentsCount(), MAX_WELEM) *
+                Encoder::protocolSize(qid);
+    case MessageType::TOpen:
+    case MessageType::TCreate:
+        return headerSize() + Encoder::protocolSize(qid) + Encoder::protocolSize(count);
+    case MessageType::TRead:
+        // Note: count is set by a client, so it must be bound before the addition to avoid overflow.
+        return headerSize() +
+                Encoder::protocolSize(count) +
+                std::min(request.asRead().count, maxReadCount());
+    case MessageType::TWrite:
+    case MessageType::TSWrite:
+        return headerSize() + Encoder::protocolSize(count);
+
+    // Responses with no data:
+    case MessageType::TFlush:
+    case MessageType::TClunk:
+    case MessageType::TRemove:
+    case MessageType::TWStat:
+    case MessageType::TSession:
+        return headerSize();
+
+    // Stat strings and the whole file content are only bound by the message size:
+    case MessageType::TStat:
+    case MessageType::TSRead:
+    default:
+        return maxNegotiatedMessageSize();
+    }
+}
+
+
+Protocol::size_type
+Protocol::memoryCost(MessageHeader const& header, Request const& request) const {
+    return header.messageSize + maxResponseSize(request);
+}
+
+
+Protocol::size_type
+Protocol::maxReadCount(size_type iounit) const noexcept {
+    size_type const count = 0;
+    size_type const overhead = headerSize() + Encoder::protocolSize(count);  // Read response header
+    size_type const maxCount = (maxNegotiatedMessageSize() > overhead)
+            ? maxNegotiatedMessageSize() - overhead
+            : 0;
+
+    return (iounit == 0)
+            ? maxCount
+            : std::min(iounit, maxCount);
+}
+
+
+Protocol::size_type
+Protocol::maxWriteCount(size_type iounit) const noexcept {
+    Fid const fid = 0;
+    uint64 const offset = 0;
+    size_type const count = 0;
+    size_type const overhead = headerSize() +     // Write request header
+            Encoder::protocolSize(fid) +
+            Encoder::protocolSize(offset) +
+            Encoder::protocolSize(count);
+    size_type const maxCount = (maxNegotiatedMessageSize() > overhead)
+            ? maxNegotiatedMessageSize() - overhead
+            : 0;
+
+    return (iounit == 0)
+            ? maxCount
+            : std::min(iounit, maxCount);
+}
+
+
+Protocol::size_type
+Protocol::ioSize(Request const& request) const noexcept {
+    switch (request.type()) {
+    case MessageType::TRead:    return std::min(request.asRead().count, maxReadCount());
+    case MessageType::TWrite:   return request.asWrite().data.size();
+    case MessageType::TSWrite:  return request.asShortWrite().data.size();
+    default:
+        return 0;
+    }
+}
+
+
+Protocol::RequestPriority
+Protocol::priority(Request const& request, size_type bulkIOThreshold) const noexcept {
+    switch (request.type()) {
+    case MessageType::TFlush:   return RequestPriority::Flush;
+    case MessageType::TRead:
+    case MessageType::TWrite:
+    case MessageType::TSWrite:
+        return (ioSize(request) > bulkIOThreshold)
+                ? RequestPriority::BulkIO
+                : RequestPriority::SmallIO;
+    // Note: size of the file is not known up-front, but short reads are meant for small files.
+    case MessageType::TSRead:   return RequestPriority::SmallIO;
+    default:
+        return RequestPriority::Metadata;
+    }
+}
+
+
+bool
+Protocol::isIdempotent(Request const& request) noexcept {
+    switch (request.type()) {
+    case MessageType::TRead:
+    case MessageType::TStat:
+    case MessageType::TSRead:
+        return true;
+    case MessageType::TWalk:
+        return (request.asWalk().fid != request.asWalk().newfid);
+    default:
+        return false;
+    }
+}
+
+
 Protocol::Protocol(size_type maxMassageSize, StringView version) :
     _maxMassageSize(maxMassageSize),
     _maxNegotiatedMessageSize(maxMassageSize),
@@ -630,6 +819,35 @@ Protocol::Request::~Request() {
 }
 
 
+Protocol::Fid
+Protocol::Request::fid() const noexcept {
+    switch (_type) {
+    case MessageType::TAuth:    return auth.afid;
+    case MessageType::TAttach:  return attach.fid;
+    case MessageType::TWalk:    return walk.fid;
+    case MessageType::TOpen:    return open.fid;
+    case MessageType::TCreate:  return create.fid;
+    case MessageType::TRead:    return read.fid;
+    case MessageType::TWrite:   return write.fid;
+    case MessageType::TClunk:   return clunk.fid;
+    case MessageType::TRemove:  return remove.fid;
+    case MessageType::TStat:    return stat.fid;
+    case MessageType::TWStat:   return wstat.fid;
+
+    /* 9P2000.e extention */
+    case MessageType::TSRead:   return shortRead.fid;
+    case MessageType::TSWrite:  return shortWrite.fid;
+
+    // Requests that are not bound to a file:
+    case MessageType::TVersion:
+    case MessageType::TFlush:
+    case MessageType::TSession:
+    default:
+        return NOFID;
+    }
+}
+
+
 Protocol::Request::Version&
 Protocol::Request::asVersion() {
     if (_type != MessageType::TVersion) {
@@ -775,6 +993,151 @@ Protocol::Request::asShortWrite(){
 }
 
 
+Protocol::Request::Version const&
+Protocol::Request::asVersion() const {
+    if (_type != MessageType::TVersion) {
+        Solace::raise<IOException>("Incorrect message type");
+    }
+
+    return version;
+}
+
+Protocol::Request::Auth const&
+Protocol::Request::asAuth() const {
+    if (_type != MessageType::TAuth) {
+        Solace::raise<IOException>("Incorrect message type");
+    }
+
+    return auth;
+}
+
+Protocol::Request::Flush const&
+Protocol::Request::asFlush() const {
+    if (_type != MessageType::TFlush) {
+        Solace::raise<IOException>("Incorrect message type");
+    }
+
+    return flush;
+}
+
+Protocol::Request::Attach const&
+Protocol::Request::asAttach() const {
+    if (_type != MessageType::TAttach) {
+        Solace::raise<IOException>("Incorrect message type");
+    }
+
+    return attach;
+}
+
+Protocol::Request::Walk const&
+Protocol::Request::asWalk() const {
+    if (_type != MessageType::TWalk) {
+        Solace::raise<IOException>("Incorrect message type");
+    }
+
+    return walk;
+}
+
+Protocol::Request::Open const&
+Protocol::Request::asOpen() const {
+    if (_type != MessageType::TOpen) {
+        Solace::raise<IOException>("Incorrect message type");
+    }
+
+    return open;
+}
+
+Protocol::Request::Create const&
+Protocol::Request::asCreate() const {
+    if (_type != MessageType::TCreate) {
+        Solace::raise<IOException>("Incorrect message type");
+    }
+
+    return create;
+}
+
+Protocol::Request::Read const&
+Protocol::Request::asRead() const {
+    if (_type != MessageType::TRead) {
+        Solace::raise<IOException>("Incorrect message type");
+    }
+
+    return read;
+}
+
+Protocol::Request::Write const&
+Protocol::Request::asWrite() const {
+    if (_type != MessageType::TWrite) {
+        Solace::raise<IOException>("Incorrect message type");
+    }
+
+    return write;
+}
+
+Protocol::Request::Clunk const&
+Protocol::Request::asClunk() const {
+    if (_type != MessageType::TClunk) {
+        Solace::raise<IOException>("Incorrect message type");
+    }
+
+    return clunk;
+}
+
+Protocol::Request::Remove const&
+Protocol::Request::asRemove() const {
+    if (_type != MessageType::TRemove) {
+        Solace::raise<IOException>("Incorrect message type");
+    }
+
+    return remove;
+}
+
+Protocol::Request::StatRequest const&
+Protocol::Request::asStat() const {
+    if (_type != MessageType::TStat) {
+        Solace::raise<IOException>("Incorrect message type");
+    }
+
+    return stat;
+}
+
+Protocol::Request::WStat const&
+Protocol::Request::asWstat() const {
+    if (_type != MessageType::TWStat) {
+        Solace::raise<IOException>("Incorrect message type");
+    }
+
+    return wstat;
+}
+
+Protocol::Request::Session const&
+Protocol::Request::asSession() const {
+    if (_type != MessageType::TSession) {
+        Solace::raise<IOException>("Incorrect message type");
+    }
+
+    return session;
+}
+
+Protocol::Request::SRead const&
+Protocol::Request::asShortRead() const {
+    if (_type != MessageType::TSRead) {
+        Solace::raise<IOException>("Incorrect message type");
+    }
+
+    return shortRead;
+}
+
+Protocol::Request::SWrite const&
+Protocol::Request::asShortWrite() const {
+    if (_type != MessageType::TSWrite) {
+        Solace::raise<IOException>("Incorrect message type");
+    }
+
+    return shortWrite;
+}
+
+
 
 
 Protocol::Response::Response(MessageType msgType, Tag msgTag) :
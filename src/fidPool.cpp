@@ -0,0 +1,93 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+
+#include "styxe/fidPool.hpp"
+
+#include <algorithm>  // std::min
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+constexpr FidPool::size_type FidPool::kCapacity;
+
+
+FidPool::FidPool(size_type limit) noexcept :
+    _limit(std::min(limit, kCapacity)),
+    _size(0),
+    _firstFreeWord(0)
+{
+    for (auto& word : _bits) {
+        word = 0;
+    }
+}
+
+
+Protocol::Fid
+FidPool::allocate() noexcept {
+    constexpr size_type kWords = kCapacity / kBitsPerWord;
+    if (_size >= _limit) {
+        return Protocol::NOFID;
+    }
+
+    for (auto i = _firstFreeWord; i < kWords; ++i) {
+        auto& word = _bits[i];
+        if (word == ~uint64(0)) {
+            continue;
+        }
+
+        size_type bit = 0;
+        while (word & (uint64(1) << bit)) {
+            ++bit;
+        }
+
+        word |= (uint64(1) << bit);
+        _size += 1;
+        _firstFreeWord = i;
+
+        return i * kBitsPerWord + bit;
+    }
+
+    _firstFreeWord = kWords;
+
+    return Protocol::NOFID;
+}
+
+
+bool
+FidPool::release(Protocol::Fid fid) noexcept {
+    if (!isAllocated(fid)) {
+        return false;
+    }
+
+    auto const wordIndex = fid / kBitsPerWord;
+    _bits[wordIndex] &= ~(uint64(1) << (fid % kBitsPerWord));
+    _size -= 1;
+
+    if (wordIndex < _firstFreeWord) {
+        _firstFreeWord = wordIndex;
+    }
+
+    return true;
+}
+
+
+bool
+FidPool::isAllocated(Protocol::Fid fid) const noexcept {
+    return (fid < kCapacity) &&
+            (_bits[fid / kBitsPerWord] & (uint64(1) << (fid % kBitsPerWord))) != 0;
+}
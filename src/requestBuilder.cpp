@@ -18,6 +18,8 @@
 
 #include <solace/exception.hpp>
 
+#include <algorithm>  // std::min
+
 
 using namespace Solace;
 using namespace styxe;
@@ -224,26 +226,82 @@ Protocol::RequestBuilder::write(Fid fid, uint64 offset, MemoryView data) {
 }
 
 
+Protocol::size_type
+Protocol::RequestBuilder::walkMessageCount(Path const& path) noexcept {
+    auto const componentsCount = path.getComponentsCount();
+
+    // Note: walk of an empty path is still a message, that clones a fid.
+    return (componentsCount == 0)
+            ? 1
+            : static_cast<size_type>((componentsCount + MAX_WELEM - 1) / MAX_WELEM);
+}
+
+
 Protocol::RequestBuilder&
 Protocol::RequestBuilder::walk(Fid fid, Fid nfid, Path const& path) {
+    if (walkMessageCount(path) > 1) {
+        Solace::raise<IOException>("Too many path elements for a single walk message");
+    }
+
+    return walk(fid, nfid, path, 0);
+}
+
+
+Protocol::RequestBuilder&
+Protocol::RequestBuilder::walk(Fid fid, Fid nfid, Path const& path, size_type part) {
+    auto const partsCount = walkMessageCount(path);
+    assertIndexInRange(part, 0, partsCount);
+
+    // Note: a walk that stops short leaves newfid unchanged, so if newfid is fid, the following parts
+    // would walk from the wrong directory.
+    if (partsCount > 1 && fid == nfid) {
+        Solace::raise<IOException>("Walk of more then MAX_WELEM path elements requires a new fid");
+    }
+
+    // All parts of the chain but the first walk from the new fid.
+    Fid const fromFid = (part == 0) ? fid : nfid;
+    auto const firstComponent = static_cast<Path::size_type>(part) * MAX_WELEM;
+    auto const nwname = static_cast<uint16>(std::min<Path::size_type>(path.getComponentsCount() - firstComponent,
+                                                                      MAX_WELEM));
+    auto component = path.begin();
+    for (Path::size_type i = 0; i < firstComponent; ++i) {
+        ++component;
+    }
+
     Encoder encode(buffer());
 
     // Compute message size first:
     _payloadSize =
-            encode.protocolSize(fid) +
+            encode.protocolSize(fromFid) +
             encode.protocolSize(nfid) +
-            encode.protocolSize(path);
+            encode.protocolSize(nwname);
+
+    auto const partBegin = component;
+    for (uint16 i = 0; i < nwname; ++i, ++component) {
+        _payloadSize += encode.protocolSize((*component).view());
+    }
 
     _type = MessageType::TWalk;
     encode.header(type(), _tag, _payloadSize)
-            .encode(fid)
+            .encode(fromFid)
             .encode(nfid)
-            .encode(path);
+            .encode(nwname);
+
+    component = partBegin;
+    for (uint16 i = 0; i < nwname; ++i, ++component) {
+        encode.encode((*component).view());
+    }
 
     return (*this);
 }
 
 
+Protocol::RequestBuilder&
+Protocol::RequestBuilder::clone(Fid fid, Fid nfid) {
+    return walk(fid, nfid, Path());
+}
+
+
 Protocol::RequestBuilder&
 Protocol::RequestBuilder::stat(Fid fid) {
     Encoder encode(buffer());
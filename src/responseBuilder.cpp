@@ -46,8 +46,22 @@ Protocol::ResponseBuilder::updatePayloadSize() {
     }
 
     const auto newPayloadSize = dataLoad - headerSize();
+    updatePayloadSize(newPayloadSize);
+
+    // Data size field of a read response must match the payload written in place.
+    if (type() == MessageType::RRead || type() == MessageType::RSRead) {
+        if (_payloadSize < sizeof(size_type)) {
+            Solace::raise<IOException>("Read response data size has not been written.");
+        }
+
+        const auto endPosition = _buffer.position();
+        _buffer.reset(_initialPosition + headerSize());
+        Encoder(_buffer)
+                .encode(static_cast<size_type>(_payloadSize - sizeof(size_type)));
+        _buffer.reset(endPosition);
+    }
 
-    return updatePayloadSize(newPayloadSize);
+    return (*this);
 }
 
 
@@ -59,7 +73,8 @@ Protocol::ResponseBuilder::build(bool recalcPayloadSize) {
     }
 
     if (recalcPayloadSize) {
-        updatePayloadSize(_buffer.position() - headerSize());
+        // Note: builder may have been given a buffer with some messages already in it.
+        updatePayloadSize();
     }
 
     return _buffer.flip();
@@ -162,6 +177,29 @@ Protocol::ResponseBuilder::walk(const Array<Qid>& qids) {
     return (*this);
 }
 
+Protocol::ResponseBuilder&
+Protocol::ResponseBuilder::walk(Response::Walk const& walk) {
+    assertIndexInRange(walk.nqids, 0, MAX_WELEM + 1);
+
+    buffer().reset(_initialPosition);
+    Encoder encode(buffer());
+
+    _type = MessageType::RWalk;
+    // Compute message size first:
+    _payloadSize =
+            encode.protocolSize(walk.nqids) +
+            walk.nqids * encode.protocolSize(Qid{});
+
+    encode.header(type(), _tag, _payloadSize)
+            .encode(walk.nqids);
+
+    for (uint16 i = 0; i < walk.nqids; ++i) {
+        encode.encode(walk.qids[i]);
+    }
+
+    return (*this);
+}
+
 Protocol::ResponseBuilder&
 Protocol::ResponseBuilder::open(const Qid& qid, size_type iounit) {
     buffer().reset(_initialPosition);
@@ -217,6 +255,12 @@ Protocol::ResponseBuilder::read(const MemoryView& data) {
 }
 
 
+Protocol::ResponseBuilder&
+Protocol::ResponseBuilder::read() {
+    return read(MemoryView());
+}
+
+
 Protocol::ResponseBuilder&
 Protocol::ResponseBuilder::write(size_type count) {
     buffer().reset(_initialPosition);
@@ -323,6 +367,12 @@ Protocol::ResponseBuilder::shortRead(const MemoryView& data) {
 }
 
 
+Protocol::ResponseBuilder&
+Protocol::ResponseBuilder::shortRead() {
+    return shortRead(MemoryView());
+}
+
+
 Protocol::ResponseBuilder&
 Protocol::ResponseBuilder::shortWrite(size_type count) {
     buffer().reset(_initialPosition);
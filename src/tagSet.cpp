@@ -0,0 +1,68 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+
+#include "styxe/tagSet.hpp"
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+TagSet::TagSet() noexcept {
+    clear();
+}
+
+
+bool
+TagSet::contains(Protocol::Tag tag) const noexcept {
+    return (_bits[tag / kBitsPerWord] & (uint64(1) << (tag % kBitsPerWord))) != 0;
+}
+
+
+bool
+TagSet::insert(Protocol::Tag tag) noexcept {
+    if (contains(tag)) {
+        return false;
+    }
+
+    _bits[tag / kBitsPerWord] |= (uint64(1) << (tag % kBitsPerWord));
+    _size += 1;
+
+    return true;
+}
+
+
+bool
+TagSet::erase(Protocol::Tag tag) noexcept {
+    if (!contains(tag)) {
+        return false;
+    }
+
+    _bits[tag / kBitsPerWord] &= ~(uint64(1) << (tag % kBitsPerWord));
+    _size -= 1;
+
+    return true;
+}
+
+
+void
+TagSet::clear() noexcept {
+    for (auto& word : _bits) {
+        word = 0;
+    }
+
+    _size = 0;
+}
@@ -174,6 +174,122 @@ TEST(P9_2000, parsingIllFormedHeaderForMessagesLargerMTUShouldError) {
 }
 
 
+TEST(P9_2000, extensionIsNegotiatedByDefault) {
+    Protocol proc;
+    ASSERT_TRUE(proc.isExtensionNegotiated());
+
+    proc.setNegotiatedVersion(makeString("9P2000"));
+    ASSERT_FALSE(proc.isExtensionNegotiated());
+}
+
+
+TEST(P9_2000, maxReadCountFitsNegotiatedMessageSize) {
+    Protocol proc;
+    proc.maxNegotiatedMessageSize(1024);
+
+    // RRead header + count field + data should fit into a message.
+    ASSERT_EQ(1024 - Protocol::headerSize() - sizeof(uint32), proc.maxReadCount());
+    ASSERT_EQ(512, proc.maxReadCount(512));
+    ASSERT_EQ(proc.maxReadCount(), proc.maxReadCount(64*1024));
+}
+
+
+TEST(P9_2000, maxWriteCountFitsNegotiatedMessageSize) {
+    Protocol proc;
+    proc.maxNegotiatedMessageSize(1024);
+
+    byte memBuffer[1024];
+    byte const data[1024] = {0};
+    auto writer = ByteWriter{wrapMemory(memBuffer)};
+
+    // Write of the max count should produce a message of exactly negotiated size.
+    Protocol::RequestBuilder(writer)
+            .write(42, 0, wrapMemory(data, proc.maxWriteCount()));
+    ASSERT_EQ(proc.maxNegotiatedMessageSize(), writer.position());
+
+    ASSERT_EQ(512, proc.maxWriteCount(512));
+    ASSERT_EQ(proc.maxWriteCount(), proc.maxWriteCount(64*1024));
+}
+
+
+TEST(P9_2000, qidOfChangedFileIsDifferent) {
+    Protocol::Qid const qid{1, 12, 4096};
+    Protocol::Qid changedQid = qid;
+    changedQid.version += 1;
+
+    ASSERT_EQ(qid, (Protocol::Qid{1, 12, 4096}));
+    ASSERT_NE(qid, changedQid);
+
+    std::hash<Protocol::Qid> qidHash;
+    ASSERT_EQ(qidHash(qid), qidHash(Protocol::Qid{1, 12, 4096}));
+    ASSERT_NE(qidHash(qid), qidHash(changedQid));
+}
+
+
+TEST(P9_2000, frameSizeOfPartialMessages) {
+    Protocol proc;
+
+    byte memBuffer[512];
+    auto writer = ByteWriter{wrapMemory(memBuffer)};
+    Protocol::RequestBuilder(writer)
+            .read(42, 12, 418);
+
+    auto const messageSize = writer.position();
+
+    // Not enough data to read the header:
+    auto partialHeader = proc.frameSize(wrapMemory(memBuffer, 3));
+    ASSERT_TRUE(partialHeader.isOk());
+    ASSERT_EQ(proc.headerSize(), partialHeader.unwrap());
+
+    // Header only:
+    auto headerOnly = proc.frameSize(wrapMemory(memBuffer, proc.headerSize()));
+    ASSERT_TRUE(headerOnly.isOk());
+    ASSERT_EQ(messageSize, headerOnly.unwrap());
+}
+
+TEST(P9_2000, parsingFramesInPlace) {
+    Protocol proc;
+
+    byte memBuffer[512];
+    auto writer = ByteWriter{wrapMemory(memBuffer)};
+    Protocol::RequestBuilder(writer)
+            .clunk(24)
+            .tag(2)
+            .read(42, 12, 418);
+
+    auto data = wrapMemory(memBuffer).slice(0, writer.position());
+    Protocol::Tag expectedTag = 1;
+    while (!data.empty()) {
+        auto sizeResult = proc.frameSize(data);
+        ASSERT_TRUE(sizeResult.isOk());
+
+        auto const frameSize = sizeResult.unwrap();
+        ASSERT_LE(frameSize, data.size());
+
+        ByteReader reader(data.slice(0, frameSize));
+        auto header = proc.parseMessageHeader(reader);
+        ASSERT_TRUE(header.isOk());
+        ASSERT_EQ(expectedTag, header.unwrap().tag);
+        ASSERT_TRUE(proc.parseRequest(header.unwrap(), reader).isOk());
+
+        data = data.slice(frameSize, data.size());
+        expectedTag += 1;
+    }
+
+    ASSERT_EQ(3, expectedTag);
+}
+
+TEST(P9_2000, frameSizeOfIllformedMessage) {
+    Protocol proc;
+
+    byte memBuffer[512];
+    auto writer = ByteWriter{wrapMemory(memBuffer)};
+    writeHeader(writer, proc.maxNegotiatedMessageSize() + 1, Protocol::MessageType::TVersion, 1);
+
+    ASSERT_TRUE(proc.frameSize(wrapMemory(memBuffer)).isError());
+}
+
+
 TEST(P9_2000, parseIncorrectlySizedSmallerResponse) {
     MemoryManager _mem(1024);
     Protocol proc;
@@ -625,6 +741,22 @@ TEST_F(P9Messages, createReadRespose) {
             });
 }
 
+TEST_F(P9Messages, createReadResposeInPlace) {
+    const char content[] = "Good news everyone!";
+    auto data = wrapMemory(content);
+
+    Protocol::ResponseBuilder responseBuilder(_writer, 1);
+    responseBuilder.read();
+    // Write data straight into the message buffer
+    responseBuilder.buffer().write(data);
+    responseBuilder.build(true);
+
+    getResponseOfFail(Protocol::MessageType::RRead)
+            .then([data](Protocol::Response&& response) {
+                ASSERT_EQ(data, response.read.data);
+            });
+}
+
 TEST_F(P9Messages, parseReadRespose) {
     auto const messageData = StringLiteral{"This is a very important data d-_^b"};
     const uint32 dataLen = messageData.size();
@@ -685,6 +817,27 @@ TEST_F(P9Messages, parseWriteRespose) {
 
 
 
+TEST_F(P9Messages, parseWriteRequestOwningFrame) {
+    const char messageData[] = "This is a very important data d-_^b";
+    auto data = wrapMemory(messageData);
+
+    MemoryManager memManager(Protocol::MAX_MESSAGE_SIZE);
+    auto frame = memManager.allocate(Protocol::headerSize() + 4 + 8 + 4 + data.size() + 16);
+    ByteWriter writer(frame.view());
+    Protocol::RequestBuilder(writer)
+            .write(15927, 98, data);
+
+    auto result = proc.parseRequest(std::move(frame));
+    ASSERT_TRUE(result.isOk());
+
+    auto owned = std::move(result.unwrap());
+    ASSERT_EQ(Protocol::MessageType::TWrite, owned.request.type());
+    ASSERT_EQ(15927, owned.request.asWrite().fid);
+    ASSERT_EQ(98, owned.request.asWrite().offset);
+    ASSERT_EQ(data, owned.request.asWrite().data);
+}
+
+
 TEST_F(P9Messages, createClunkRequest) {
     Protocol::RequestBuilder(_writer)
             .clunk(37509)
@@ -811,6 +964,49 @@ TEST_F(P9Messages, parseStatRespose) {
 }
 
 
+TEST_F(P9Messages, copyStatOutOfMessageBuffer) {
+    Protocol::Stat stat;
+    stat.atime = 21;
+    stat.dev = 8828;
+    stat.gid = "Some user";
+    stat.length = 818177;
+    stat.mode = 111;
+    stat.mtime = 17;
+    stat.name = "File McFileface";
+    stat.qid.path = 61;
+    stat.qid.type = 15;
+    stat.qid.version = 404;
+    stat.size = 124;
+    stat.type = 1;
+    stat.uid = "User McUserface";
+    stat.muid = "Some other user";
+
+    Protocol::ResponseBuilder(_writer, 1)
+            .stat(stat)
+            .build();
+
+    byte storage[256];
+    auto storageWriter = ByteWriter{wrapMemory(storage)};
+
+    getResponseOfFail(Protocol::MessageType::RStat)
+            .then([&storageWriter](Protocol::Response&& response) {
+                Protocol::Encoder(storageWriter)
+                        .encode(response.stat);
+            });
+
+    ASSERT_EQ(Protocol::Encoder::protocolSize(stat), storageWriter.position());
+
+    Protocol::Stat copy;
+    auto storageReader = ByteReader{wrapMemory(storage, storageWriter.position())};
+    ASSERT_TRUE(Protocol::Decoder(storageReader).read(&copy).isOk());
+    ASSERT_EQ(stat, copy);
+
+    // Strings of the copy must not refer to the message buffer
+    ASSERT_GE(copy.muid.data(), reinterpret_cast<char const*>(storage));
+    ASSERT_LT(copy.muid.data(), reinterpret_cast<char const*>(storage + sizeof(storage)));
+}
+
+
 TEST_F(P9Messages, createWStatRequest) {
     Protocol::Stat stat;
     stat.atime = 21;
@@ -884,6 +1080,91 @@ TEST_F(P9Messages, createWalkEmptyPathRequest) {
 }
 
 
+TEST_F(P9Messages, walkRequestLongerThanMaxWalkElementsIsSplit) {
+    auto const path = makePath("1", "2", "3", "4", "5", "6", "7", "8", "9", "10",
+                               "11", "12", "13", "14", "15", "16", "17", "18", "19", "20");
+    ASSERT_EQ(2, Protocol::RequestBuilder::walkMessageCount(path));
+
+    Protocol::RequestBuilder builder(_writer);
+    builder.tag(3).walk(213, 124, path, 0)
+            .tag(7).walk(213, 124, path, 1)
+            .build();
+
+    auto data = _writer.viewRemaining();
+
+    // First message walks MAX_WELEM elements from the original fid
+    auto firstSize = proc.frameSize(data);
+    ASSERT_TRUE(firstSize.isOk());
+    ByteReader firstReader(data.slice(0, firstSize.unwrap()));
+    auto firstHeader = proc.parseMessageHeader(firstReader);
+    ASSERT_TRUE(firstHeader.isOk());
+    ASSERT_EQ(3, firstHeader.unwrap().tag);
+
+    auto first = proc.parseRequest(firstHeader.unwrap(), firstReader);
+    ASSERT_TRUE(first.isOk());
+    ASSERT_EQ(213, first.unwrap().asWalk().fid);
+    ASSERT_EQ(124, first.unwrap().asWalk().newfid);
+    ASSERT_EQ(Protocol::MAX_WELEM, first.unwrap().asWalk().path.getComponentsCount());
+
+    // Second message walks the rest from the new fid
+    data = data.slice(firstSize.unwrap(), data.size());
+    ByteReader secondReader(data);
+    auto secondHeader = proc.parseMessageHeader(secondReader);
+    ASSERT_TRUE(secondHeader.isOk());
+    ASSERT_EQ(7, secondHeader.unwrap().tag);
+
+    auto second = proc.parseRequest(secondHeader.unwrap(), secondReader);
+    ASSERT_TRUE(second.isOk());
+    ASSERT_EQ(124, second.unwrap().asWalk().fid);
+    ASSERT_EQ(124, second.unwrap().asWalk().newfid);
+    ASSERT_EQ(makePath("17", "18", "19", "20"), second.unwrap().asWalk().path);
+}
+
+TEST_F(P9Messages, walkRequestLongerThanMaxWalkElementsNeedsParts) {
+    auto const path = makePath("1", "2", "3", "4", "5", "6", "7", "8", "9", "10",
+                               "11", "12", "13", "14", "15", "16", "17");
+
+    ASSERT_THROW(Protocol::RequestBuilder(_writer)
+                 .walk(213, 124, path),
+                 Solace::Exception);
+    ASSERT_THROW(Protocol::RequestBuilder(_writer)
+                 .walk(213, 124, path, 2),
+                 Solace::Exception);
+}
+
+TEST_F(P9Messages, splitWalkRequestToItselfIsRejected) {
+    auto const path = makePath("1", "2", "3", "4", "5", "6", "7", "8", "9", "10",
+                               "11", "12", "13", "14", "15", "16", "17");
+
+    // A walk that stops short leaves the fid unchanged, so the next part would walk from the wrong file.
+    ASSERT_THROW(Protocol::RequestBuilder(_writer)
+                 .walk(5, 5, path, 0),
+                 Solace::Exception);
+    ASSERT_THROW(Protocol::RequestBuilder(_writer)
+                 .walk(5, 5, path, 1),
+                 Solace::Exception);
+}
+
+TEST_F(P9Messages, walkMessageCount) {
+    ASSERT_EQ(1, Protocol::RequestBuilder::walkMessageCount(Path()));
+    ASSERT_EQ(1, Protocol::RequestBuilder::walkMessageCount(makePath("space", "knowhere")));
+}
+
+
+TEST_F(P9Messages, createCloneRequest) {
+    Protocol::RequestBuilder(_writer)
+            .clone(7374, 542)
+            .build();
+
+    getRequestOfFail(Protocol::MessageType::TWalk)
+            .then([](Protocol::Request&& request) {
+                ASSERT_EQ(7374, request.asWalk().fid);
+                ASSERT_EQ(542, request.asWalk().newfid);
+                ASSERT_TRUE(request.asWalk().path.empty());
+            });
+}
+
+
 TEST_F(P9Messages, createWalkRespose) {
     auto qids = makeArray<Protocol::Qid>(3);
     qids[2].path = 21;
@@ -900,6 +1181,24 @@ TEST_F(P9Messages, createWalkRespose) {
             });
 }
 
+TEST_F(P9Messages, createWalkResposeFromFixedQids) {
+    Protocol::Response::Walk walk;
+    walk.nqids = 2;
+    walk.qids[0] = Protocol::Qid{12, 1, 7};
+    walk.qids[1] = Protocol::Qid{81, 117, 21};
+
+    Protocol::ResponseBuilder(_writer, 1)
+            .walk(walk)
+            .build();
+
+    getResponseOfFail(Protocol::MessageType::RWalk)
+            .then([&walk](Protocol::Response&& response) {
+                ASSERT_EQ(walk.nqids, response.walk.nqids);
+                ASSERT_EQ(walk.qids[0], response.walk.qids[0]);
+                ASSERT_EQ(walk.qids[1], response.walk.qids[1]);
+            });
+}
+
 TEST_F(P9Messages, parseWalkRespose) {
     auto const qid = Protocol::Qid {
             87,
@@ -930,6 +1229,298 @@ TEST_F(P9Messages, parseWalkRespose) {
 }
 
 
+TEST_F(P9Messages, parseWalkResposeWithTooManyQids) {
+    Protocol::Qid const qid{87, 5481, 17};
+    uint16 const nqids = Protocol::MAX_WELEM + 1;
+
+    writeHeader(_writer, Protocol::headerSize() + sizeof(uint16) + nqids * Protocol::Encoder::protocolSize(qid),
+                Protocol::MessageType::RWalk, 1);
+    _writer.writeLE(nqids);
+    for (uint16 i = 0; i < nqids; ++i) {
+        encode9P(_writer, qid);
+    }
+
+    _writer.flip();
+    _reader.limit(_writer.limit());
+
+    auto headerResult = proc.parseMessageHeader(_reader);
+    ASSERT_TRUE(headerResult.isOk());
+    ASSERT_TRUE(proc.parseResponse(headerResult.unwrap(), _reader).isError());
+}
+
+
+TEST_F(P9Messages, requestFid) {
+    Protocol::RequestBuilder(_writer)
+            .read(7234, 18, 772)
+            .build();
+
+    getRequestOfFail(Protocol::MessageType::TRead)
+            .then([](Protocol::Request&& request) {
+                ASSERT_EQ(7234, request.fid());
+            });
+}
+
+TEST_F(P9Messages, walkRequestFidIsTheSourceFid) {
+    Protocol::RequestBuilder(_writer)
+            .walk(213, 124, makePath("space", "knowhere"))
+            .build();
+
+    getRequestOfFail(Protocol::MessageType::TWalk)
+            .then([](Protocol::Request&& request) {
+                ASSERT_EQ(213, request.fid());
+            });
+}
+
+TEST_F(P9Messages, flushRequestIsNotBoundToFid) {
+    Protocol::RequestBuilder(_writer)
+            .flush(7711)
+            .build();
+
+    getRequestOfFail(Protocol::MessageType::TFlush)
+            .then([](Protocol::Request&& request) {
+                ASSERT_EQ(Protocol::NOFID, request.fid());
+            });
+}
+
+
+TEST_F(P9Messages, memoryCostOfReadRequest) {
+    Protocol::RequestBuilder(_writer)
+            .read(7374, 18, 4096)
+            .build();
+
+    Protocol::MessageHeader header{};
+    header.messageSize = _writer.limit();
+
+    getRequestOfFail(Protocol::MessageType::TRead)
+            .then([this, &header](Protocol::Request&& request) {
+                // Request itself plus RRead header, count field and the data requested:
+                ASSERT_EQ(header.messageSize + Protocol::headerSize() + sizeof(uint32) + 4096,
+                          proc.memoryCost(header, request));
+            });
+}
+
+
+TEST_F(P9Messages, memoryCostOfReadRequestWithMaxCount) {
+    Protocol::RequestBuilder(_writer)
+            .read(7374, 18, 0xFFFFFFFF)
+            .build();
+
+    Protocol::MessageHeader header{};
+    header.messageSize = _writer.limit();
+
+    getRequestOfFail(Protocol::MessageType::TRead)
+            .then([this, &header](Protocol::Request&& request) {
+                // Response to a read can be no larger then negotiated message size
+                ASSERT_EQ(header.messageSize + proc.maxNegotiatedMessageSize(), proc.memoryCost(header, request));
+            });
+}
+
+
+TEST_F(P9Messages, ioSizeOfReadRequestWithMaxCount) {
+    Protocol::RequestBuilder(_writer)
+            .read(7374, 18, 0xFFFFFFFF)
+            .build();
+
+    getRequestOfFail(Protocol::MessageType::TRead)
+            .then([this](Protocol::Request&& request) {
+                // No response can carry more data then that
+                ASSERT_EQ(proc.maxReadCount(), proc.ioSize(request));
+                ASSERT_EQ(Protocol::RequestPriority::BulkIO, proc.priority(request));
+            });
+}
+
+
+TEST_F(P9Messages, ioSizeOfWriteRequest) {
+    const char messageData[] = "This is a very important data d-_^b";
+    auto data = wrapMemory(messageData);
+
+    Protocol::RequestBuilder(_writer)
+            .write(15927, 98, data)
+            .build();
+
+    getRequestOfFail(Protocol::MessageType::TWrite)
+            .then([this, data](Protocol::Request&& request) {
+                ASSERT_EQ(data.size(), proc.ioSize(request));
+            });
+}
+
+TEST_F(P9Messages, ioSizeOfMetadataRequest) {
+    Protocol::RequestBuilder(_writer)
+            .attach(3310, 1841, "McFace", "close to u")
+            .build();
+
+    getRequestOfFail(Protocol::MessageType::TAttach)
+            .then([this](Protocol::Request&& request) {
+                ASSERT_EQ(0u, proc.ioSize(request));
+            });
+}
+
+
+TEST_F(P9Messages, readRequestIsIdempotent) {
+    Protocol::RequestBuilder(_writer)
+            .read(7374, 18, 4096)
+            .build();
+
+    getRequestOfFail(Protocol::MessageType::TRead)
+            .then([](Protocol::Request&& request) {
+                ASSERT_TRUE(Protocol::isIdempotent(request));
+            });
+}
+
+TEST_F(P9Messages, writeRequestIsNotIdempotent) {
+    const char messageData[] = "This is a very important data d-_^b";
+
+    Protocol::RequestBuilder(_writer)
+            .write(15927, 98, wrapMemory(messageData))
+            .build();
+
+    getRequestOfFail(Protocol::MessageType::TWrite)
+            .then([](Protocol::Request&& request) {
+                ASSERT_FALSE(Protocol::isIdempotent(request));
+            });
+}
+
+TEST_F(P9Messages, walkToItselfIsNotIdempotent) {
+    Protocol::RequestBuilder(_writer)
+            .walk(213, 213, makePath("space", "knowhere"))
+            .build();
+
+    getRequestOfFail(Protocol::MessageType::TWalk)
+            .then([](Protocol::Request&& request) {
+                ASSERT_FALSE(Protocol::isIdempotent(request));
+            });
+}
+
+
+TEST_F(P9Messages, priorityOfMetadataRequest) {
+    Protocol::RequestBuilder(_writer)
+            .stat(7872)
+            .build();
+
+    getRequestOfFail(Protocol::MessageType::TStat)
+            .then([this](Protocol::Request&& request) {
+                ASSERT_EQ(Protocol::RequestPriority::Metadata, proc.priority(request));
+            });
+}
+
+TEST_F(P9Messages, priorityOfFlushRequest) {
+    Protocol::RequestBuilder(_writer)
+            .flush(7711)
+            .build();
+
+    getRequestOfFail(Protocol::MessageType::TFlush)
+            .then([this](Protocol::Request&& request) {
+                ASSERT_EQ(Protocol::RequestPriority::Flush, proc.priority(request));
+            });
+}
+
+TEST_F(P9Messages, priorityOfReadRequest) {
+    Protocol::RequestBuilder(_writer)
+            .read(7234, 18, 772)
+            .build();
+
+    getRequestOfFail(Protocol::MessageType::TRead)
+            .then([this](Protocol::Request&& request) {
+                ASSERT_EQ(Protocol::RequestPriority::SmallIO, proc.priority(request));
+                ASSERT_EQ(Protocol::RequestPriority::BulkIO, proc.priority(request, 512));
+            });
+}
+
+
+TEST_F(P9Messages, maxResponseSizeOfFixedSizeResponses) {
+    Protocol::RequestBuilder(_writer)
+            .open(517, Protocol::OpenMode::RDWR)
+            .build();
+
+    getRequestOfFail(Protocol::MessageType::TOpen)
+            .then([this](Protocol::Request&& request) {
+                auto const expectedSize = proc.maxResponseSize(request);
+
+                _writer.clear();
+                Protocol::ResponseBuilder(_writer, request.tag())
+                        .open(Protocol::Qid{8, 13, 323}, 817);
+
+                ASSERT_EQ(_writer.position(), expectedSize);
+            });
+}
+
+TEST_F(P9Messages, maxResponseSizeOfWalk) {
+    Protocol::RequestBuilder(_writer)
+            .walk(213, 124, makePath("space", "knowhere", "else"))
+            .build();
+
+    getRequestOfFail(Protocol::MessageType::TWalk)
+            .then([this](Protocol::Request&& request) {
+                auto const expectedSize = proc.maxResponseSize(request);
+
+                _writer.clear();
+                Protocol::ResponseBuilder(_writer, request.tag())
+                        .walk(makeArray<Protocol::Qid>(3));
+
+                ASSERT_EQ(_writer.position(), expectedSize);
+            });
+}
+
+TEST_F(P9Messages, maxResponseSizeOfWalkIsBoundByMaxWalkElements) {
+    auto const path = makePath("1", "2", "3", "4", "5", "6", "7", "8", "9", "10",
+                               "11", "12", "13", "14", "15", "16", "17", "18", "19", "20");
+
+    // Note: encode walk request manually as RequestBuilder splits long walks.
+    auto const headPosition = _writer.position();
+    writeHeader(_writer, 0, Protocol::MessageType::TWalk, 1);
+    Protocol::Encoder(_writer)
+            .encode(Protocol::Fid(213))
+            .encode(Protocol::Fid(124))
+            .encode(path);
+
+    const auto totalSize = _writer.position();
+    _writer.limit(totalSize);
+    _writer.reset(headPosition);
+    _writer.writeLE(Protocol::size_type(totalSize));
+
+    getRequestOfFail(Protocol::MessageType::TWalk)
+            .then([this](Protocol::Request&& request) {
+                ASSERT_EQ(20, request.asWalk().path.getComponentsCount());
+                ASSERT_EQ(proc.headerSize() + sizeof(uint16) + Protocol::MAX_WELEM * 13,
+                          proc.maxResponseSize(request));
+            });
+}
+
+TEST_F(P9Messages, maxResponseSizeOfReadIsBoundByNegotiatedSize) {
+    Protocol::RequestBuilder(_writer)
+            .read(7234, 18, 72)
+            .build();
+
+    getRequestOfFail(Protocol::MessageType::TRead)
+            .then([this](Protocol::Request&& request) {
+                ASSERT_EQ(proc.headerSize() + sizeof(uint32) + 72, proc.maxResponseSize(request));
+            });
+
+    _writer.clear();
+    _reader.rewind();
+    Protocol::RequestBuilder(_writer)
+            .read(7234, 18, 2*Protocol::MAX_MESSAGE_SIZE)
+            .build();
+
+    getRequestOfFail(Protocol::MessageType::TRead)
+            .then([this](Protocol::Request&& request) {
+                ASSERT_EQ(proc.maxNegotiatedMessageSize(), proc.maxResponseSize(request));
+            });
+}
+
+
+TEST_F(P9Messages, maxResponseSizeOfReadWithMaxCount) {
+    Protocol::RequestBuilder(_writer)
+            .read(7234, 18, 0xFFFFFFFF)
+            .build();
+
+    getRequestOfFail(Protocol::MessageType::TRead)
+            .then([this](Protocol::Request&& request) {
+                ASSERT_EQ(proc.maxNegotiatedMessageSize(), proc.maxResponseSize(request));
+            });
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 /// 9P2000.e
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -952,6 +1543,19 @@ TEST_F(P9E_Messages, createSessionRequest) {
             });
 }
 
+TEST_F(P9E_Messages, sessionRequestId) {
+    const byte sessionKey[8] = {8, 7, 6, 5, 4, 3, 2, 1};
+
+    Protocol::RequestBuilder(_writer)
+            .session(wrapMemory(sessionKey))
+            .build();
+
+    getRequestOfFail(Protocol::MessageType::TSession)
+            .then([](Protocol::Request&& request) {
+                ASSERT_EQ(0x0102030405060708ULL, request.asSession().id());
+            });
+}
+
 TEST_F(P9E_Messages, createSessionRequest_NotEnoughData) {
     const byte sessionKey[5] = {8, 7, 6, 5, 4};
 
@@ -1027,6 +1631,23 @@ TEST_F(P9E_Messages, createShortReadRespose) {
 }
 
 
+TEST_F(P9E_Messages, createShortReadResposeInPlace) {
+    const char messageData[] = "This was somewhat important data d^_-b";
+    auto data = wrapMemory(messageData);
+
+    Protocol::ResponseBuilder responseBuilder(_writer, 1);
+    responseBuilder.shortRead();
+    // Write data straight into the message buffer
+    responseBuilder.buffer().write(data);
+    responseBuilder.build(true);
+
+    getResponseOfFail(Protocol::MessageType::RSRead)
+            .then([data](Protocol::Response&& response) {
+                EXPECT_EQ(data, response.read.data);
+            });
+}
+
+
 TEST_F(P9E_Messages, parseShortReadRespose) {
     auto const messageData = StringLiteral{"This is a very important data d-_^b"};
     const uint32 dataLen = messageData.size();
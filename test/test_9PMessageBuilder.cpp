@@ -89,3 +89,94 @@ TEST_F(P9MessageBuilder, messageChanging) {
     ASSERT_EQ(Protocol::headerSize() + payloadSize, _buffer.position());
     ASSERT_EQ(Protocol::MessageType::RError, builder.type());
 }
+
+
+TEST_F(P9MessageBuilder, batchingResponsesIntoOneBuffer) {
+    Protocol proc;
+
+    Protocol::ResponseBuilder(_buffer, 1)
+            .clunk();
+    const auto firstMessageSize = _buffer.position();
+
+    MemoryView emptyBuffer;
+    Protocol::ResponseBuilder builder(_buffer, 2);
+    builder.read(emptyBuffer);
+
+    // Write extra data:
+    const byte extraData[] = {1, 3, 2, 45, 18};
+    builder.buffer().write(wrapMemory(extraData, 5));
+    builder.build(true);
+
+    ASSERT_EQ(4 + 5, builder.payloadSize());
+    ASSERT_EQ(firstMessageSize + Protocol::headerSize() + 4 + 5, _buffer.limit());
+
+    ByteReader reader(_buffer.viewRemaining());
+    auto first = proc.parseMessageHeader(reader);
+    ASSERT_TRUE(first.isOk());
+    ASSERT_EQ(Protocol::MessageType::RClunk, first.unwrap().type);
+    ASSERT_EQ(1, first.unwrap().tag);
+    ASSERT_EQ(Protocol::headerSize(), first.unwrap().messageSize);
+
+    auto second = proc.parseMessageHeader(reader);
+    ASSERT_TRUE(second.isOk());
+    ASSERT_EQ(Protocol::MessageType::RRead, second.unwrap().type);
+    ASSERT_EQ(2, second.unwrap().tag);
+    ASSERT_EQ(Protocol::headerSize() + 4 + 5, second.unwrap().messageSize);
+}
+
+
+TEST_F(P9MessageBuilder, pipeliningDependentRequests) {
+    Protocol proc;
+
+    // Fids are chosen by a client, so requests using a new fid can be sent without waiting for a walk to complete.
+    Protocol::RequestBuilder builder(_buffer);
+    builder.tag(1).walk(1, 42, makePath("etc", "hosts"))
+            .tag(2).open(42, Protocol::OpenMode::READ)
+            .tag(3).read(42, 0, 512)
+            .build();
+
+    auto data = _buffer.viewRemaining();
+    const Protocol::MessageType expectedTypes[] = {
+        Protocol::MessageType::TWalk,
+        Protocol::MessageType::TOpen,
+        Protocol::MessageType::TRead
+    };
+
+    Protocol::Tag expectedTag = 1;
+    for (auto expectedType : expectedTypes) {
+        auto frameSize = proc.frameSize(data);
+        ASSERT_TRUE(frameSize.isOk());
+
+        ByteReader reader(data.slice(0, frameSize.unwrap()));
+        auto header = proc.parseMessageHeader(reader);
+        ASSERT_TRUE(header.isOk());
+        ASSERT_EQ(expectedType, header.unwrap().type);
+        ASSERT_EQ(expectedTag, header.unwrap().tag);
+
+        ASSERT_TRUE(proc.parseRequest(header.unwrap(), reader).isOk());
+
+        data = data.slice(frameSize.unwrap(), data.size());
+        expectedTag += 1;
+    }
+
+    ASSERT_TRUE(data.empty());
+}
+
+
+TEST_F(P9MessageBuilder, updatingPayloadSizeOfReadResponseUpdatesDataSize) {
+    Protocol::ResponseBuilder builder(_buffer, 1);
+    builder.read();
+
+    const byte extraData[] = {1, 3, 2, 45, 18};
+    builder.buffer().write(wrapMemory(extraData, 5));
+    builder.updatePayloadSize();
+
+    ByteReader reader(_buffer.viewWritten());
+    Protocol proc;
+    auto header = proc.parseMessageHeader(reader);
+    ASSERT_TRUE(header.isOk());
+
+    auto response = proc.parseResponse(header.unwrap(), reader);
+    ASSERT_TRUE(response.isOk());
+    ASSERT_EQ(wrapMemory(extraData, 5), response.unwrap().read.data);
+}
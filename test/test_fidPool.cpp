@@ -0,0 +1,104 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+/*******************************************************************************
+ * libcadence Unit Test Suit
+ * @file: test/test_fidPool.cpp
+ *
+ *******************************************************************************/
+#include "styxe/fidPool.hpp"  // Class being tested
+
+#include "gtest/gtest.h"
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+TEST(FidPool, defaultConstructedPoolIsEmpty) {
+    FidPool fids;
+
+    ASSERT_TRUE(fids.empty());
+    ASSERT_EQ(0u, fids.size());
+    ASSERT_FALSE(fids.isAllocated(0));
+    ASSERT_FALSE(fids.isAllocated(Protocol::NOFID));
+}
+
+
+TEST(FidPool, allocateLowestAvailableFid) {
+    FidPool fids;
+
+    ASSERT_EQ(0u, fids.allocate());
+    ASSERT_EQ(1u, fids.allocate());
+    ASSERT_EQ(2u, fids.allocate());
+    ASSERT_EQ(3u, fids.size());
+    ASSERT_TRUE(fids.isAllocated(1));
+
+    ASSERT_TRUE(fids.release(1));
+    ASSERT_FALSE(fids.isAllocated(1));
+    ASSERT_EQ(2u, fids.size());
+
+    // Released fid is reused
+    ASSERT_EQ(1u, fids.allocate());
+    ASSERT_EQ(3u, fids.allocate());
+}
+
+
+TEST(FidPool, releaseOfUnallocatedFid) {
+    FidPool fids;
+
+    ASSERT_FALSE(fids.release(17));
+    ASSERT_FALSE(fids.release(Protocol::NOFID));
+
+    auto const fid = fids.allocate();
+    ASSERT_TRUE(fids.release(fid));
+    ASSERT_FALSE(fids.release(fid));
+    ASSERT_TRUE(fids.empty());
+}
+
+
+TEST(FidPool, exhaustedPool) {
+    FidPool fids;
+    for (FidPool::size_type i = 0; i < FidPool::kCapacity; ++i) {
+        ASSERT_EQ(i, fids.allocate());
+    }
+
+    ASSERT_EQ(FidPool::kCapacity, fids.size());
+    ASSERT_EQ(Protocol::NOFID, fids.allocate());
+
+    ASSERT_TRUE(fids.release(4242));
+    ASSERT_EQ(4242u, fids.allocate());
+}
+
+
+TEST(FidPool, poolWithLimitRunsOut) {
+    FidPool fids(2);
+    ASSERT_EQ(2u, fids.limit());
+
+    ASSERT_EQ(0u, fids.allocate());
+    ASSERT_EQ(1u, fids.allocate());
+    ASSERT_EQ(Protocol::NOFID, fids.allocate());
+
+    ASSERT_TRUE(fids.release(0));
+    ASSERT_EQ(0u, fids.allocate());
+    ASSERT_EQ(Protocol::NOFID, fids.allocate());
+}
+
+
+TEST(FidPool, limitIsBoundByCapacity) {
+    FidPool fids(2*FidPool::kCapacity);
+
+    ASSERT_EQ(FidPool::kCapacity, fids.limit());
+}
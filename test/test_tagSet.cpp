@@ -0,0 +1,82 @@
+/*
+*  Copyright 2018 Ivan Ryabov
+*
+*  Licensed under the Apache License, Version 2.0 (the "License");
+*  you may not use this file except in compliance with the License.
+*  You may obtain a copy of the License at
+*
+*      http://www.apache.org/licenses/LICENSE-2.0
+*
+*  Unless required by applicable law or agreed to in writing, software
+*  distributed under the License is distributed on an "AS IS" BASIS,
+*  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+*  See the License for the specific language governing permissions and
+*  limitations under the License.
+*/
+/*******************************************************************************
+ * libcadence Unit Test Suit
+ * @file: test/test_tagSet.cpp
+ *
+ *******************************************************************************/
+#include "styxe/tagSet.hpp"  // Class being tested
+
+#include "gtest/gtest.h"
+
+
+using namespace Solace;
+using namespace styxe;
+
+
+TEST(TagSet, defaultConstructedSetIsEmpty) {
+    TagSet tags;
+
+    ASSERT_TRUE(tags.empty());
+    ASSERT_EQ(0u, tags.size());
+    ASSERT_FALSE(tags.contains(0));
+    ASSERT_FALSE(tags.contains(Protocol::NO_TAG));
+}
+
+
+TEST(TagSet, insertAndErase) {
+    TagSet tags;
+
+    ASSERT_TRUE(tags.insert(1));
+    ASSERT_TRUE(tags.insert(64));
+    ASSERT_TRUE(tags.insert(Protocol::NO_TAG));
+    ASSERT_EQ(3u, tags.size());
+
+    ASSERT_TRUE(tags.contains(1));
+    ASSERT_TRUE(tags.contains(64));
+    ASSERT_TRUE(tags.contains(Protocol::NO_TAG));
+    ASSERT_FALSE(tags.contains(0));
+    ASSERT_FALSE(tags.contains(65));
+
+    ASSERT_TRUE(tags.erase(64));
+    ASSERT_FALSE(tags.contains(64));
+    ASSERT_EQ(2u, tags.size());
+}
+
+
+TEST(TagSet, duplicateTagIsNotAdded) {
+    TagSet tags;
+
+    ASSERT_TRUE(tags.insert(7711));
+    ASSERT_FALSE(tags.insert(7711));
+    ASSERT_EQ(1u, tags.size());
+
+    ASSERT_TRUE(tags.erase(7711));
+    ASSERT_FALSE(tags.erase(7711));
+    ASSERT_TRUE(tags.empty());
+}
+
+
+TEST(TagSet, clear) {
+    TagSet tags;
+    tags.insert(3);
+    tags.insert(300);
+
+    tags.clear();
+    ASSERT_TRUE(tags.empty());
+    ASSERT_FALSE(tags.contains(3));
+    ASSERT_FALSE(tags.contains(300));
+}